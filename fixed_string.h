@@ -28,6 +28,7 @@
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <type_traits>
 
 namespace std {
 namespace experimental {
@@ -267,7 +268,7 @@ constexpr long long stoll(const fixed_string<N>& str) {
     if (i > m10) throw invalid_argument("");
     i *= 10;
     const char c = str[pos];
-    if ('0' < c || c > '9') throw invalid_argument("");
+    if (c < '0' || c > '9') throw invalid_argument("");
     const int d = c - '0';
     unsigned long long j = i + d;
     if (j < i) throw invalid_argument("");
@@ -296,7 +297,7 @@ constexpr unsigned long long stoull(const fixed_string<N>& str) {
     if (i > m10) throw invalid_argument("");
     i *= 10;
     const char c = str[pos];
-    if ('0' < c || c > '9') throw invalid_argument("");
+    if (c < '0' || c > '9') throw invalid_argument("");
     const int d = c - '0';
     unsigned long long j = i + d;
     if (j < i) throw invalid_argument("");
@@ -323,7 +324,7 @@ constexpr size_t __count_num_digits_signed(long long val) noexcept {
     constexpr unsigned long long m = numeric_limits<unsigned long long>::max();
     const unsigned long long mn = m + val;
     const unsigned long long mq = m - mn;
-    return __count_num_digits_unsigned(mq);
+    return 1 + __count_num_digits_unsigned(mq);  // +1 for '-'
   } else
     return __count_num_digits_unsigned(val);
 }
@@ -331,33 +332,39 @@ constexpr size_t __count_num_digits_signed(long long val) noexcept {
 template <unsigned long long val>
 constexpr fixed_string<__count_num_digits_unsigned(val)>
 to_fixed_string_ull() noexcept {
-  if (val == 0) return "0";
-
   constexpr size_t N = __count_num_digits_unsigned(val);
   fixed_string<N> str;
 
   unsigned long long remaining = val;
 
-  for (size_t pos = N - 1; remaining > 0; pos--, remaining /= 10) {
-    str[pos] = remaining % 10ull;
+  for (size_t pos = N; pos > 0; pos--, remaining /= 10) {
+    str[pos - 1] = '0' + remaining % 10ull;
   }
   return str;
 }
 
+// Negative and non-negative cases of to_fixed_string_ll.  Dispatched on sign
+// so that only the branch matching the return type is instantiated.
+template <long long val>
+constexpr fixed_string<__count_num_digits_signed(val)> __to_fixed_string_ll(
+    true_type /* negative */) noexcept {
+  constexpr unsigned long long m = numeric_limits<unsigned long long>::max();
+  constexpr unsigned long long mn = m + val;
+  constexpr unsigned long long mq = m - mn;
+  return "-" + to_fixed_string_ull<mq>();
+}
+
+template <long long val>
+constexpr fixed_string<__count_num_digits_signed(val)> __to_fixed_string_ll(
+    false_type /* negative */) noexcept {
+  constexpr unsigned long long val_ull = val;
+  return to_fixed_string_ull<val_ull>();
+}
+
 template <long long val>
 constexpr fixed_string<__count_num_digits_signed(val)>
 to_fixed_string_ll() noexcept {
-  if (val == 0)
-    return "0";
-  else if (val < 0) {
-    constexpr unsigned long long m = numeric_limits<unsigned long long>::max();
-    constexpr unsigned long long mn = m + val;
-    constexpr unsigned long long mq = m - mn;
-    return "-" + to_fixed_string_ull<mq>();
-  } else {
-    constexpr unsigned long long val_ull = val;
-    return to_fixed_string_ull<val_ull>();
-  }
+  return __to_fixed_string_ll<val>(integral_constant<bool, (val < 0)>());
 }
 
 template <int val>
@@ -491,7 +498,7 @@ class basic_fixed_string {
   constexpr reference back() noexcept { return data_[N - 1]; }
 
  private:
-  static size_t __substr_length(size_t pos, size_t count) {
+  static constexpr size_t __substr_length(size_t pos, size_t count) {
     if (pos >= N)
       return 0;
     else if (count == npos || pos + count > N)
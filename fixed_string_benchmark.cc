@@ -0,0 +1,281 @@
+// Runtime benchmarks comparing basic_fixed_string against std::string and
+// string_view for construction, copy, concatenation, comparison, find and
+// stoi/stoll, for N = 1..1024.
+//
+// Results are exported in machine-readable form by the benchmark library:
+//
+//   fixed_string_benchmark --benchmark_out_format=json
+//                          --benchmark_out=fixed_string_benchmark.json
+//
+// to_fixed_string takes its value as a template argument and has no runtime
+// cost; see fixed_string_constexpr_benchmark.cc for it and for other
+// compile-time costs.
+
+#include "core/fixed_string.h"
+
+#include <cstdlib>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+using std::experimental::fixed_string;
+using std::experimental::string_view;
+
+namespace {
+
+// A char[N + 1] source filled at runtime so construction is not folded away.
+template <size_t N>
+struct Source {
+  Source() {
+    for (size_t i = 0; i < N; i++) arr[i] = 'a' + i % 26;
+    arr[N] = 0;
+  }
+  char arr[N + 1];
+};
+
+// A char[N + 1] source of N decimal digits.
+template <size_t N>
+struct DigitSource {
+  DigitSource() {
+    for (size_t i = 0; i < N; i++) arr[i] = '1' + i % 9;
+    arr[N] = 0;
+  }
+  char arr[N + 1];
+};
+
+// Construction.
+
+template <size_t N>
+void BM_Construct_FixedString(benchmark::State& state) {
+  Source<N> src;
+  for (auto _ : state) {
+    fixed_string<N> s(src.arr);
+    benchmark::DoNotOptimize(s);
+  }
+}
+
+template <size_t N>
+void BM_Construct_String(benchmark::State& state) {
+  Source<N> src;
+  for (auto _ : state) {
+    std::string s(src.arr, N);
+    benchmark::DoNotOptimize(s);
+  }
+}
+
+template <size_t N>
+void BM_Construct_StringView(benchmark::State& state) {
+  Source<N> src;
+  for (auto _ : state) {
+    string_view s(src.arr, N);
+    benchmark::DoNotOptimize(s);
+  }
+}
+
+// Copy.
+
+template <size_t N>
+void BM_Copy_FixedString(benchmark::State& state) {
+  Source<N> src;
+  const fixed_string<N> s(src.arr);
+  for (auto _ : state) {
+    fixed_string<N> t(s);
+    benchmark::DoNotOptimize(t);
+  }
+}
+
+template <size_t N>
+void BM_Copy_String(benchmark::State& state) {
+  Source<N> src;
+  const std::string s(src.arr, N);
+  for (auto _ : state) {
+    std::string t(s);
+    benchmark::DoNotOptimize(t);
+  }
+}
+
+template <size_t N>
+void BM_Copy_StringView(benchmark::State& state) {
+  Source<N> src;
+  const string_view s(src.arr, N);
+  for (auto _ : state) {
+    string_view t(s);
+    benchmark::DoNotOptimize(t);
+  }
+}
+
+// Concatenation.  string_view has no concatenation.
+
+template <size_t N>
+void BM_Concat_FixedString(benchmark::State& state) {
+  Source<N> src;
+  const fixed_string<N> s(src.arr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    auto t = s + s;
+    benchmark::DoNotOptimize(t);
+  }
+}
+
+template <size_t N>
+void BM_Concat_String(benchmark::State& state) {
+  Source<N> src;
+  const std::string s(src.arr, N);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    std::string t = s + s;
+    benchmark::DoNotOptimize(t);
+  }
+}
+
+// Comparison of two equal strings, the worst case.
+
+template <size_t N>
+void BM_Compare_FixedString(benchmark::State& state) {
+  Source<N> src;
+  const fixed_string<N> s1(src.arr), s2(src.arr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s1);
+    benchmark::DoNotOptimize(s2);
+    benchmark::DoNotOptimize(s1 == s2);
+    benchmark::DoNotOptimize(s1 < s2);
+  }
+}
+
+template <size_t N>
+void BM_Compare_String(benchmark::State& state) {
+  Source<N> src;
+  const std::string s1(src.arr, N), s2(src.arr, N);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s1);
+    benchmark::DoNotOptimize(s2);
+    benchmark::DoNotOptimize(s1 == s2);
+    benchmark::DoNotOptimize(s1 < s2);
+  }
+}
+
+template <size_t N>
+void BM_Compare_StringView(benchmark::State& state) {
+  Source<N> src;
+  const string_view s1(src.arr, N), s2(src.arr, N);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s1);
+    benchmark::DoNotOptimize(s2);
+    benchmark::DoNotOptimize(s1 == s2);
+    benchmark::DoNotOptimize(s1 < s2);
+  }
+}
+
+// Find of a character that is not present, the worst case.
+
+template <size_t N>
+void BM_Find_FixedString(benchmark::State& state) {
+  Source<N> src;
+  const fixed_string<N> s(src.arr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.find('!'));
+  }
+}
+
+template <size_t N>
+void BM_Find_String(benchmark::State& state) {
+  Source<N> src;
+  const std::string s(src.arr, N);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.find('!'));
+  }
+}
+
+template <size_t N>
+void BM_Find_StringView(benchmark::State& state) {
+  Source<N> src;
+  const string_view s(src.arr, N);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.find('!'));
+  }
+}
+
+// stoi/stoll.  N is bounded by the digits that fit in the result type.
+
+template <size_t N>
+void BM_Stoi_FixedString(benchmark::State& state) {
+  DigitSource<N> src;
+  const fixed_string<N> s(src.arr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(stoi(s));
+  }
+}
+
+template <size_t N>
+void BM_Stoi_String(benchmark::State& state) {
+  DigitSource<N> src;
+  const std::string s(src.arr, N);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(std::stoi(s));
+  }
+}
+
+template <size_t N>
+void BM_Stoll_FixedString(benchmark::State& state) {
+  DigitSource<N> src;
+  const fixed_string<N> s(src.arr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(stoll(s));
+  }
+}
+
+template <size_t N>
+void BM_Stoll_String(benchmark::State& state) {
+  DigitSource<N> src;
+  const std::string s(src.arr, N);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(std::stoll(s));
+  }
+}
+
+}  // namespace
+
+#define FIXED_STRING_BENCHMARK_N(name) \
+  BENCHMARK_TEMPLATE(name, 1);         \
+  BENCHMARK_TEMPLATE(name, 4);         \
+  BENCHMARK_TEMPLATE(name, 16);        \
+  BENCHMARK_TEMPLATE(name, 64);        \
+  BENCHMARK_TEMPLATE(name, 256);       \
+  BENCHMARK_TEMPLATE(name, 1024)
+
+#define FIXED_STRING_BENCHMARK_DIGITS(name) \
+  BENCHMARK_TEMPLATE(name, 1);              \
+  BENCHMARK_TEMPLATE(name, 4);              \
+  BENCHMARK_TEMPLATE(name, 9)
+
+#define FIXED_STRING_BENCHMARK_LONG_DIGITS(name) \
+  FIXED_STRING_BENCHMARK_DIGITS(name);           \
+  BENCHMARK_TEMPLATE(name, 18)
+
+FIXED_STRING_BENCHMARK_N(BM_Construct_FixedString);
+FIXED_STRING_BENCHMARK_N(BM_Construct_String);
+FIXED_STRING_BENCHMARK_N(BM_Construct_StringView);
+FIXED_STRING_BENCHMARK_N(BM_Copy_FixedString);
+FIXED_STRING_BENCHMARK_N(BM_Copy_String);
+FIXED_STRING_BENCHMARK_N(BM_Copy_StringView);
+FIXED_STRING_BENCHMARK_N(BM_Concat_FixedString);
+FIXED_STRING_BENCHMARK_N(BM_Concat_String);
+FIXED_STRING_BENCHMARK_N(BM_Compare_FixedString);
+FIXED_STRING_BENCHMARK_N(BM_Compare_String);
+FIXED_STRING_BENCHMARK_N(BM_Compare_StringView);
+FIXED_STRING_BENCHMARK_N(BM_Find_FixedString);
+FIXED_STRING_BENCHMARK_N(BM_Find_String);
+FIXED_STRING_BENCHMARK_N(BM_Find_StringView);
+FIXED_STRING_BENCHMARK_DIGITS(BM_Stoi_FixedString);
+FIXED_STRING_BENCHMARK_DIGITS(BM_Stoi_String);
+FIXED_STRING_BENCHMARK_LONG_DIGITS(BM_Stoll_FixedString);
+FIXED_STRING_BENCHMARK_LONG_DIGITS(BM_Stoll_String);
+
+BENCHMARK_MAIN();
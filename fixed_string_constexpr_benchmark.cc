@@ -0,0 +1,124 @@
+// Compile-time benchmarks for large constexpr fixed_string workloads: long
+// operator+ chains, big substr trees and many to_fixed_string instantiations.
+// This translation unit has no runtime component; its cost is the cost of
+// compiling it.
+//
+// Workload sizes are set with -D:
+//
+//   FIXED_STRING_BENCH_CHAIN_LENGTH     number of operator+ in the chain
+//   FIXED_STRING_BENCH_TREE_SIZE        length of the string split by substr
+//   FIXED_STRING_BENCH_TO_STRING_COUNT  number of to_fixed_string values
+//
+// A size of 0 disables that workload.
+//
+// Compile time is exported in machine-readable form by the compiler, e.g.
+// clang -ftime-trace (Chrome trace JSON) or gcc -ftime-report.  Constexpr
+// evaluation steps are the smallest -fconstexpr-steps (clang) or
+// -fconstexpr-ops-limit (gcc) at which this file still compiles.
+
+#include "core/fixed_string.h"
+
+#include <utility>
+
+#ifndef FIXED_STRING_BENCH_CHAIN_LENGTH
+#define FIXED_STRING_BENCH_CHAIN_LENGTH 256
+#endif
+
+#ifndef FIXED_STRING_BENCH_TREE_SIZE
+#define FIXED_STRING_BENCH_TREE_SIZE 1024
+#endif
+
+#ifndef FIXED_STRING_BENCH_TO_STRING_COUNT
+#define FIXED_STRING_BENCH_TO_STRING_COUNT 256
+#endif
+
+using std::experimental::fixed_string;
+using std::experimental::make_fixed_string;
+using std::experimental::to_fixed_string_ll;
+using std::experimental::to_fixed_string_ull;
+
+namespace {
+
+// "ab" + "ab" + ... + "ab", K times, as a left-leaning operator+ chain.
+// Evaluation recurses once per operator+, so lengths past about 500 need
+// -fconstexpr-depth and -ftemplate-depth raised to about 2 * K;
+// fixed_string_constexpr_benchmark.py passes both.
+template <size_t K>
+struct Chain {
+  static constexpr fixed_string<2 * K> value() {
+    return Chain<K - 1>::value() + "ab";
+  }
+};
+
+template <>
+struct Chain<0> {
+  static constexpr fixed_string<0> value() { return {}; }
+};
+
+// A string of N letters.
+template <size_t N>
+constexpr fixed_string<N> Letters() {
+  fixed_string<N> s;
+  for (size_t i = 0; i < N; i++) s[i] = 'a' + i % 26;
+  return s;
+}
+
+// Splits str in halves with substr, recurses on each, and rejoins them with
+// operator+, yielding a copy of str built from a tree of N leaves.
+template <size_t N>
+struct SubstrTree {
+  static constexpr fixed_string<N> value(const fixed_string<N>& str) {
+    return SubstrTree<N / 2>::value(str.template substr<0, N / 2>()) +
+           SubstrTree<N - N / 2>::value(str.template substr<N / 2>());
+  }
+};
+
+template <>
+struct SubstrTree<1> {
+  static constexpr fixed_string<1> value(const fixed_string<1>& str) {
+    return str;
+  }
+};
+
+template <>
+struct SubstrTree<0> {
+  static constexpr fixed_string<0> value(const fixed_string<0>& str) {
+    return str;
+  }
+};
+
+// The i-th to_fixed_string value, spread over all digit counts.
+constexpr unsigned long long ToStringValue(size_t i) {
+  return i * 0x9E3779B97F4A7C15ull >> (i % 64);
+}
+
+// Instantiates to_fixed_string_ull and to_fixed_string_ll for each value and
+// checks that stoull/stoll round-trip the results.  Each call is a separate
+// constant evaluation, so only compile time grows with the count.
+template <size_t... I>
+constexpr bool ToStringRoundTrips(std::index_sequence<I...>) {
+  constexpr bool ok[] = {
+      true,
+      (stoull(to_fixed_string_ull<ToStringValue(I)>()) == ToStringValue(I) &&
+       stoll(to_fixed_string_ll<-(long long)(ToStringValue(I) >> 1)>()) ==
+           -(long long)(ToStringValue(I) >> 1))...};
+  for (bool b : ok)
+    if (!b) return false;
+  return true;
+}
+
+constexpr auto chain = Chain<FIXED_STRING_BENCH_CHAIN_LENGTH>::value();
+static_assert(chain.size() == 2 * FIXED_STRING_BENCH_CHAIN_LENGTH, "");
+static_assert(FIXED_STRING_BENCH_CHAIN_LENGTH < 2 ||
+                  chain.substr<0, 4>() == "abab",
+              "");
+
+constexpr auto letters = Letters<FIXED_STRING_BENCH_TREE_SIZE>();
+constexpr auto tree = SubstrTree<FIXED_STRING_BENCH_TREE_SIZE>::value(letters);
+static_assert(tree == letters, "");
+
+static_assert(ToStringRoundTrips(std::make_index_sequence<
+                                 FIXED_STRING_BENCH_TO_STRING_COUNT>()),
+              "");
+
+}  // namespace
@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""Runs the compile-time benchmarks in fixed_string_constexpr_benchmark.cc.
+
+Each workload is compiled on its own at several sizes, with the other
+workloads disabled.  For each size this records:
+
+  real_time       best compiler wall time over --repetitions compiles, in
+                  seconds
+  cpu_time        best compiler user + system CPU time, in seconds
+  constexpr_ops   smallest -fconstexpr-ops-limit (gcc) or -fconstexpr-steps
+                  (clang) at which the file still compiles, i.e. the cost of
+                  the most expensive single constant evaluation.  null for
+                  ToString: each to_fixed_string_*<V>() call is its own
+                  constant evaluation, so the most expensive one does not
+                  grow with the number of values and only the times
+                  track that workload
+
+Results are written as JSON in the layout of the runtime suite's
+--benchmark_out_format=json, with constexpr_ops as a user counter.  Google
+Benchmark's compare.py can diff the times but ignores counters, so compare
+two result files with this script instead, which diffs both:
+
+  fixed_string_constexpr_benchmark.py --compare OLD.json NEW.json
+
+It exits with status 1 if any constexpr_ops grew by more than
+--max-ops-increase.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import resource
+import subprocess
+import sys
+import time
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                      'fixed_string_constexpr_benchmark.cc')
+
+# Workload name -> size macro.
+WORKLOADS = {
+    'Chain': 'FIXED_STRING_BENCH_CHAIN_LENGTH',
+    'SubstrTree': 'FIXED_STRING_BENCH_TREE_SIZE',
+    'ToString': 'FIXED_STRING_BENCH_TO_STRING_COUNT',
+}
+
+DEFAULT_SIZES = {
+    'Chain': [16, 64, 256, 1024],
+    'SubstrTree': [16, 64, 256, 1024],
+    'ToString': [16, 64, 256, 1024],
+}
+
+# Workloads without a meaningful constexpr_ops; see the module docstring.
+UNTRACKED_OPS = {'ToString'}
+
+MAX_OPS = 1 << 31
+
+
+class Compiler(object):
+
+  def __init__(self, path, std, include_dir):
+    self.path = path
+    self.std = std
+    self.include_dir = include_dir
+    self.version = subprocess.run(
+        [path, '--version'], stdout=subprocess.PIPE,
+        universal_newlines=True, check=True).stdout.splitlines()[0]
+    self.is_clang = 'clang' in self.version
+
+  def ops_flag(self, limit):
+    if self.is_clang:
+      return '-fconstexpr-steps=%d' % limit
+    return '-fconstexpr-ops-limit=%d' % limit
+
+  def command(self, defines, ops_limit):
+    # The chain recurses once per operator+, so its length is otherwise capped
+    # by the default constexpr and template depth limits.
+    depth = max(1024, 2 * defines[WORKLOADS['Chain']])
+    cmd = [self.path, '-std=' + self.std, '-fsyntax-only',
+           '-I' + self.include_dir, self.ops_flag(ops_limit),
+           '-fconstexpr-depth=%d' % depth, '-ftemplate-depth=%d' % depth]
+    cmd += ['-D%s=%d' % (k, v) for k, v in sorted(defines.items())]
+    cmd.append(SOURCE)
+    return cmd
+
+  def compile(self, defines, ops_limit):
+    """Returns (succeeded, wall time, CPU time, diagnostics), in seconds."""
+    start = time.perf_counter()
+    start_usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+    result = subprocess.run(self.command(defines, ops_limit),
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+    elapsed = time.perf_counter() - start
+    cpu = (usage.ru_utime - start_usage.ru_utime +
+           usage.ru_stime - start_usage.ru_stime)
+    return result.returncode == 0, elapsed, cpu, result.stdout
+
+
+def defines_for(workload, size):
+  defines = {macro: 0 for macro in WORKLOADS.values()}
+  if workload is not None:
+    defines[WORKLOADS[workload]] = size
+  return defines
+
+
+def bisect_ops(compiler, defines, precision):
+  """Smallest ops limit that compiles, to within the given relative precision."""
+  lo, hi = 0, 1
+  while not compiler.compile(defines, hi)[0]:
+    lo, hi = hi, hi * 2
+    if hi > MAX_OPS:
+      return None
+  while hi - lo > max(1, int(hi * precision)):
+    mid = (lo + hi) // 2
+    if compiler.compile(defines, mid)[0]:
+      hi = mid
+    else:
+      lo = mid
+  return hi
+
+
+def run(compiler, name, defines, args, track_ops=True):
+  ok, _, _, diagnostics = compiler.compile(defines, MAX_OPS)
+  if not ok:
+    sys.stderr.write('%s does not compile:\n%s' % (name, diagnostics))
+    sys.exit(1)
+  times = [compiler.compile(defines, MAX_OPS)[1:3]
+           for _ in range(args.repetitions)]
+  real_time = min(t[0] for t in times)
+  cpu_time = min(t[1] for t in times)
+  ops = bisect_ops(compiler, defines, args.precision) if track_ops else None
+  print('%-28s %10.3f s %14s ops' % (name, real_time,
+                                     '-' if ops is None else ops))
+  return {
+      'name': name,
+      'run_name': name,
+      'run_type': 'iteration',
+      'repetitions': args.repetitions,
+      'repetition_index': 0,
+      'threads': 1,
+      'iterations': 1,
+      'real_time': real_time,
+      'cpu_time': cpu_time,
+      'time_unit': 's',
+      'constexpr_ops': ops,
+  }
+
+
+def change(old, new):
+  if old is None or new is None:
+    return None
+  if old == 0:
+    return 0.0 if new == 0 else float('inf')
+  return (new - old) / float(old)
+
+
+def compare(old_path, new_path, max_ops_increase):
+  """Prints per-benchmark changes; returns False on an ops regression."""
+  with open(old_path) as f:
+    old = {b['name']: b for b in json.load(f)['benchmarks']}
+  with open(new_path) as f:
+    new = {b['name']: b for b in json.load(f)['benchmarks']}
+
+  def fmt(c):
+    return '%+9.1f%%' % (100 * c) if c is not None else '%10s' % '-'
+
+  print('%-28s %10s %10s %10s' % ('Benchmark', 'real_time', 'cpu_time',
+                                  'ops'))
+  ok = True
+  for name in (n for n in new if n in old):
+    o, n = old[name], new[name]
+    ops = change(o.get('constexpr_ops'), n.get('constexpr_ops'))
+    print('%-28s %s %s %s' % (name, fmt(change(o['real_time'], n['real_time'])),
+                              fmt(change(o['cpu_time'], n['cpu_time'])),
+                              fmt(ops)))
+    if ops is not None and ops > max_ops_increase:
+      ok = False
+  return ok
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'))
+  parser.add_argument('--std', default='c++14')
+  parser.add_argument('--include-dir',
+                      help='directory containing core/fixed_string.h')
+  parser.add_argument('--out', help='JSON output file')
+  parser.add_argument('--repetitions', type=int, default=3)
+  parser.add_argument('--precision', type=float, default=0.01,
+                      help='relative precision of constexpr_ops')
+  for workload in WORKLOADS:
+    parser.add_argument('--%s-sizes' % workload.lower(), type=int, nargs='*',
+                        default=DEFAULT_SIZES[workload], dest=workload)
+  parser.add_argument('--compare', nargs=2, metavar=('OLD', 'NEW'),
+                      help='compare two result files instead of running')
+  parser.add_argument('--max-ops-increase', type=float, default=0.02,
+                      help='relative constexpr_ops growth that --compare '
+                           'reports as a regression')
+  args = parser.parse_args()
+
+  if args.compare:
+    sys.exit(0 if compare(args.compare[0], args.compare[1],
+                          args.max_ops_increase) else 1)
+  if not args.include_dir or not args.out:
+    parser.error('--include-dir and --out are required')
+
+  compiler = Compiler(args.compiler, args.std, args.include_dir)
+
+  benchmarks = [run(compiler, 'BM_Constexpr_Baseline', defines_for(None, 0),
+                    args)]
+  for workload in WORKLOADS:
+    for size in getattr(args, workload):
+      benchmarks.append(run(compiler,
+                            'BM_Constexpr_%s/%d' % (workload, size),
+                            defines_for(workload, size), args,
+                            track_ops=workload not in UNTRACKED_OPS))
+
+  output = {
+      'context': {
+          'date': datetime.datetime.now().astimezone().isoformat(),
+          'executable': compiler.path,
+          'compiler_version': compiler.version,
+          'std': compiler.std,
+      },
+      'benchmarks': benchmarks,
+  }
+  with open(args.out, 'w') as f:
+    json.dump(output, f, indent=2)
+    f.write('\n')
+
+
+if __name__ == '__main__':
+  main()
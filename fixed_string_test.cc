@@ -2,6 +2,10 @@
 
 #include "gtest/gtest.h"
 
+#ifndef STATIC_ASSERT
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif
+
 using std::experimental::fixed_string;
 using std::experimental::make_fixed_string;
 
@@ -20,3 +24,24 @@ constexpr auto s5 = s3 + s4;
 STATIC_ASSERT(s5 == "123456");
 constexpr int x = stoi(s5);
 STATIC_ASSERT(x == 123456);
+
+using std::experimental::to_fixed_string_ll;
+using std::experimental::to_fixed_string_ull;
+
+STATIC_ASSERT(stoll(make_fixed_string("-9223372036854775808")) ==
+              std::numeric_limits<long long>::min());
+STATIC_ASSERT(stoull(make_fixed_string("18446744073709551615")) ==
+              std::numeric_limits<unsigned long long>::max());
+
+STATIC_ASSERT(to_fixed_string_ull<0>() == "0");
+STATIC_ASSERT(to_fixed_string_ull<1234>() == "1234");
+STATIC_ASSERT(to_fixed_string_ll<-42>() == "-42");
+STATIC_ASSERT(to_fixed_string_ll<42>() == "42");
+STATIC_ASSERT(to_fixed_string_ll<std::numeric_limits<long long>::min()>() ==
+              "-9223372036854775808");
+
+constexpr auto s6 = make_fixed_string("abcdef");
+STATIC_ASSERT(s6.substr<1, 3>() == "bcd");
+STATIC_ASSERT(s6.substr<3>() == "def");
+STATIC_ASSERT(s6.substr<6>().empty());
+STATIC_ASSERT(s6.substr<9>().empty());